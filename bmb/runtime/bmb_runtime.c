@@ -27,6 +27,8 @@
 #include <unistd.h>  // getcwd (bmb_getcwd), rmdir (bmb_rmdir) on POSIX
 #include <sys/stat.h> // M6: file_mtime (struct stat)
 #include <sys/wait.h> // M6: waitpid for exec_with_stdin
+#include <spawn.h>   // v0.101: posix_spawnp fast path in bmb_system
+extern char** environ; // v0.101: for posix_spawnp
 #endif
 
 // v0.98: Event loop for async I/O
@@ -86,6 +88,20 @@ static __thread int g_ffi_has_error = 0;
 #define BMB_EXPORT __attribute__((visibility("default"), used))
 #endif
 
+// v0.101: Branch-prediction hint for hot-path fast cases
+#if defined(_MSC_VER)
+#define BMB_LIKELY(x) (x)
+#else
+#define BMB_LIKELY(x) __builtin_expect(!!(x), 1)
+#endif
+
+// v0.101: Read prefetch hint for probe loops (no-op where unsupported)
+#if defined(_MSC_VER)
+#define BMB_PREFETCH_R(addr) ((void)0)
+#else
+#define BMB_PREFETCH_R(addr) __builtin_prefetch((addr), 0, 0)
+#endif
+
 // Set FFI error boundary. Returns 0 on first call, non-zero on error (longjmp).
 BMB_EXPORT int bmb_ffi_begin(void) {
     g_ffi_has_error = 0;
@@ -119,11 +135,17 @@ static void bmb_ffi_trigger(const char* msg) {
     longjmp(g_ffi_jmp_buf, 1);
 }
 
+// v0.101: Interned empty string. Hot paths (getenv miss, get_arg out of
+// bounds, empty splits/joins) used to malloc a fresh empty BmbString per
+// call; every zero-length construction now returns this shared immutable
+// singleton. bmb_string_free knows to skip it.
+static char g_bmb_empty_data[1];
+static BmbString g_bmb_empty_string = { g_bmb_empty_data, 0, 0 };
+
 // Helper to create a new BmbString from raw char*
 static BmbString* bmb_string_wrap(char* data) {
     if (!data) {
-        data = (char*)bmb_alloc(1);
-        data[0] = '\0';
+        return &g_bmb_empty_string;
     }
     BmbString* s = (BmbString*)bmb_alloc(sizeof(BmbString));
     int64_t len = (int64_t)strlen(data);
@@ -488,6 +510,20 @@ void bmb_println_str(const BmbString* s) {
 }
 int64_t bmb_str_len(const char* s) { int64_t len = 0; while (s[len]) len++; return len; }
 
+// v0.101: Round a requested capacity up to a power of two. Growable buffers
+// (vec, svec, StringBuilder) all double, and doubling only stays on
+// allocator size-class boundaries if it starts on one; an arbitrary initial
+// capacity makes every later realloc request an off-class size that glibc,
+// jemalloc and mimalloc alike round up internally — wasted slack the
+// program can never use. Starting at a power of two keeps every growth
+// request an exact size class, which is also what lets in-place realloc
+// succeed most often.
+static int64_t bmb_pow2_ceil(int64_t n) {
+    int64_t p = 8;
+    while (p < n) p *= 2;
+    return p;
+}
+
 // v0.98: Vector functions
 // v0.95.5: Stable-handle layout — header never moves, only data array gets realloc'd
 // Layout: vec[0] = capacity, vec[1] = length, vec[2] = data_ptr
@@ -506,7 +542,7 @@ int64_t bmb_vec_new() {
 }
 
 int64_t bmb_vec_with_capacity(int64_t cap) {
-    if (cap < 1) cap = 1;
+    cap = bmb_pow2_ceil(cap);
     int64_t* vec = (int64_t*)malloc(3 * sizeof(int64_t));
     vec[0] = cap;  // capacity
     vec[1] = 0;    // length
@@ -514,18 +550,29 @@ int64_t bmb_vec_with_capacity(int64_t cap) {
     return (int64_t)vec;
 }
 
+// v0.101: Cold grow path kept out of line so the hot append below stays a
+// handful of instructions. Returns the (possibly moved) data pointer.
+static int64_t* bmb_vec_grow(int64_t* vec) {
+    // Grow: double capacity
+    int64_t new_cap = vec[0] * 2;
+    int64_t* new_data = (int64_t*)realloc(VEC_DATA(vec), new_cap * sizeof(int64_t));
+    vec[2] = (int64_t)new_data;  // update data pointer in header
+    vec[0] = new_cap;
+    return new_data;
+}
+
+// v0.101: Fast path specialized for the overwhelming common case (room
+// available): load len and cap once, store the value, bump len.
 int64_t bmb_vec_push(int64_t vec_ptr, int64_t value) {
     int64_t* vec = (int64_t*)vec_ptr;
-    int64_t cap = vec[0];
     int64_t len = vec[1];
-    if (len >= cap) {
-        // Grow: double capacity
-        int64_t new_cap = cap * 2;
-        int64_t* new_data = (int64_t*)realloc(VEC_DATA(vec), new_cap * sizeof(int64_t));
-        vec[2] = (int64_t)new_data;  // update data pointer in header
-        vec[0] = new_cap;
-    }
-    VEC_DATA(vec)[len] = value;
+    int64_t* data;
+    if (BMB_LIKELY(len < vec[0])) {
+        data = VEC_DATA(vec);
+    } else {
+        data = bmb_vec_grow(vec);
+    }
+    data[len] = value;
     vec[1] = len + 1;
     return vec_ptr;  // handle is always stable
 }
@@ -1241,7 +1288,7 @@ BmbString* bmb_string_concat7(const BmbString* a, const BmbString* b, const BmbS
 // Convert C string to BmbString
 // v0.88.2: Uses arena-aware allocation
 BmbString* bmb_string_from_cstr(const char* s) {
-    if (!s) return bmb_string_wrap(NULL);
+    if (!s || s[0] == '\0') return &g_bmb_empty_string;
     int64_t len = (int64_t)strlen(s);
     char* copy = (char*)bmb_alloc(len + 1);
     memcpy(copy, s, (size_t)(len + 1));
@@ -1290,6 +1337,7 @@ BMB_EXPORT void bmb_ffi_free_string(BmbString* s) {
 // Create new string with given length (allocates copy)
 // v0.88.2: Uses arena-aware allocation
 BmbString* bmb_string_new(const char* s, int64_t len) {
+    if (len <= 0) return &g_bmb_empty_string;
     char* result = (char*)bmb_alloc(len + 1);
     memcpy(result, s, (size_t)len);
     result[len] = '\0';
@@ -1672,18 +1720,39 @@ void eprintln_f64(double f) {
 }
 
 // v0.46: StringBuilder functions for efficient string building
+// v0.101: The buffer is NUL-terminated lazily — every push reserves one
+// spare byte, but only the consumers that need a C string (sb_build,
+// sb_println) write the terminator. Saves one store per push.
 typedef struct {
     char* data;
     int64_t len;
     int64_t cap;
 } StringBuilder;
 
+// v0.101: Slab-quantized growth shared by every push path. Small builders
+// double as before (amortized O(1)); past one slab the buffer grows in
+// whole slabs, so the transient over-allocation on multi-MB builders is
+// bounded by one slab instead of 2x the peak. Slab size matches the arena
+// block size; glibc serves slab-sized reallocs via mremap, so large grows
+// move pages, not bytes.
+#define SB_SLAB_SIZE (8 * 1024 * 1024)
+
+static void sb_grow(StringBuilder* sb, int64_t required) {
+    if (required <= sb->cap) return;
+    int64_t new_cap = sb->cap;
+    while (new_cap < required && new_cap < SB_SLAB_SIZE) new_cap *= 2;
+    if (new_cap < required) {
+        new_cap = (required + SB_SLAB_SIZE - 1) / SB_SLAB_SIZE * SB_SLAB_SIZE;
+    }
+    sb->data = (char*)realloc(sb->data, new_cap);
+    sb->cap = new_cap;
+}
+
 int64_t bmb_sb_new(void) {
     StringBuilder* sb = (StringBuilder*)malloc(sizeof(StringBuilder));
     sb->cap = 1024;
     sb->len = 0;
     sb->data = (char*)malloc(sb->cap);
-    sb->data[0] = '\0';
     return (int64_t)sb;
 }
 
@@ -1691,10 +1760,9 @@ int64_t bmb_sb_new(void) {
 // Avoids reallocations when final size is known
 int64_t bmb_sb_with_capacity(int64_t capacity) {
     StringBuilder* sb = (StringBuilder*)malloc(sizeof(StringBuilder));
-    sb->cap = capacity > 0 ? capacity : 64;
+    sb->cap = bmb_pow2_ceil(capacity);
     sb->len = 0;
     sb->data = (char*)malloc(sb->cap);
-    sb->data[0] = '\0';
     return (int64_t)sb;
 }
 
@@ -1707,18 +1775,11 @@ int64_t bmb_sb_push(int64_t handle, const BmbString* s) {
     if (slen == 0) return sb->len;
 
     // Grow if needed
-    int64_t required = sb->len + slen + 1;
-    if (required > sb->cap) {
-        int64_t new_cap = sb->cap;
-        while (new_cap < required) new_cap *= 2;
-        sb->data = (char*)realloc(sb->data, new_cap);
-        sb->cap = new_cap;
-    }
+    sb_grow(sb, sb->len + slen + 1);
 
-    // Append with memcpy
+    // Append with memcpy (terminator written lazily by sb_build/sb_println)
     memcpy(sb->data + sb->len, s->data, (size_t)slen);
     sb->len += slen;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1732,17 +1793,10 @@ int64_t bmb_sb_push_range(int64_t handle, const BmbString* s, int64_t start, int
     if (slen <= 0) return sb->len;
 
     // Grow if needed
-    int64_t required = sb->len + slen + 1;
-    if (required > sb->cap) {
-        int64_t new_cap = sb->cap;
-        while (new_cap < required) new_cap *= 2;
-        sb->data = (char*)realloc(sb->data, new_cap);
-        sb->cap = new_cap;
-    }
+    sb_grow(sb, sb->len + slen + 1);
 
     memcpy(sb->data + sb->len, s->data + start, (size_t)slen);
     sb->len += slen;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1752,13 +1806,9 @@ int64_t bmb_sb_push_char(int64_t handle, int64_t ch) {
     StringBuilder* sb = (StringBuilder*)handle;
 
     // Grow if needed
-    if (sb->len + 2 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
+    sb_grow(sb, sb->len + 2);
 
     sb->data[sb->len++] = (char)ch;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1784,16 +1834,12 @@ int64_t bmb_sb_push_int(int64_t handle, int64_t n) {
     if (neg) buf[i++] = '-';
 
     // Grow if needed
-    while (sb->len + i + 1 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
+    sb_grow(sb, sb->len + i + 1);
 
     // Append in reverse order
     while (i > 0) {
         sb->data[sb->len++] = buf[--i];
     }
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1815,10 +1861,7 @@ int64_t bmb_sb_push_escaped(int64_t handle, const BmbString* s) {
         }
 
         // Grow if needed (max 2 chars per iteration)
-        if (sb->len + 3 > sb->cap) {
-            sb->cap *= 2;
-            sb->data = (char*)realloc(sb->data, sb->cap);
-        }
+        sb_grow(sb, sb->len + 3);
 
         if (esc) {
             sb->data[sb->len++] = '\\';
@@ -1827,7 +1870,6 @@ int64_t bmb_sb_push_escaped(int64_t handle, const BmbString* s) {
             sb->data[sb->len++] = c;
         }
     }
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1837,13 +1879,9 @@ int64_t bmb_sb_push_f64(int64_t handle, double f) {
     StringBuilder* sb = (StringBuilder*)handle;
     char buf[64];
     int n = snprintf(buf, sizeof(buf), "%.9g", f);
-    while (sb->len + n + 1 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
+    sb_grow(sb, sb->len + n + 1);
     memcpy(sb->data + sb->len, buf, (size_t)n);
     sb->len += n;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1853,13 +1891,9 @@ int64_t bmb_sb_push_hex(int64_t handle, int64_t n) {
     StringBuilder* sb = (StringBuilder*)handle;
     char buf[32];
     int len = snprintf(buf, sizeof(buf), "0x%" PRIx64, (uint64_t)n);
-    while (sb->len + len + 1 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
+    sb_grow(sb, sb->len + len + 1);
     memcpy(sb->data + sb->len, buf, (size_t)len);
     sb->len += len;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1869,13 +1903,9 @@ int64_t bmb_sb_push_bool(int64_t handle, int64_t b) {
     StringBuilder* sb = (StringBuilder*)handle;
     const char* s = b ? "true" : "false";
     int len = b ? 4 : 5;
-    while (sb->len + len + 1 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
+    sb_grow(sb, sb->len + len + 1);
     memcpy(sb->data + sb->len, s, (size_t)len);
     sb->len += len;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
@@ -1886,13 +1916,18 @@ int64_t bmb_sb_len(int64_t handle) {
 
 // v0.51.51: sb_build returns BmbString*
 // v0.88.2: Uses arena-aware allocation
+// v0.101: The builder stores one flat buffer, so the build is a single
+// contiguous memcpy streaming at full bandwidth — no per-fragment copies.
 BmbString* bmb_sb_build(int64_t handle) {
     if (!handle) {
         return bmb_string_wrap(NULL);
     }
     StringBuilder* sb = (StringBuilder*)handle;
-    // Return copy of the built string (use memcpy + direct struct init)
+    // Return copy of the built string (use memcpy + direct struct init).
+    // Pushes always leave one spare byte, so terminating in place is safe.
     int64_t len = sb->len;
+    if (len == 0) return &g_bmb_empty_string;
+    sb->data[len] = '\0';
     char* result = (char*)bmb_alloc(len + 1);
     memcpy(result, sb->data, (size_t)(len + 1));
     BmbString* str = (BmbString*)bmb_alloc(sizeof(BmbString));
@@ -1905,7 +1940,6 @@ BmbString* bmb_sb_build(int64_t handle) {
 int64_t bmb_sb_clear(int64_t handle) {
     StringBuilder* sb = (StringBuilder*)handle;
     sb->len = 0;
-    sb->data[0] = '\0';
     return 0;
 }
 
@@ -1939,6 +1973,7 @@ int64_t bmb_sb_contains(int64_t handle, const BmbString* marker) {
 int64_t bmb_sb_println(int64_t handle) {
     StringBuilder* sb = (StringBuilder*)handle;
     if (sb && sb->data) {
+        sb->data[sb->len] = '\0';  // lazy terminator (spare byte reserved)
         puts(sb->data);  // puts adds newline automatically
     } else {
         puts("");
@@ -1961,7 +1996,7 @@ int64_t bmb_puts_cstr(const char* s) {
 // Free a BmbString and its data
 // Note: In arena mode, individual frees are no-ops (arena handles bulk deallocation)
 int64_t bmb_string_free(const BmbString* s) {
-    if (!s) return 0;
+    if (!s || s == &g_bmb_empty_string) return 0;  // interned singleton
     if (g_arena_enabled) return 0;  // Arena handles deallocation
     if (s->data) free(s->data);
     free((void*)s);
@@ -2195,32 +2230,86 @@ static void* bmb_alloc(size_t size) {
 // v0.51.18: HashMap implementation (open addressing with linear probing)
 // Based on: https://github.com/DavidLeeds/hashmap
 // See also: https://en.wikipedia.org/wiki/Linear_probing
+// v0.101: Struct-of-arrays layout — keys live in one contiguous 64-byte-
+// aligned array so probe loops can compare several keys per instruction
+// (AVX2 path below); values and probe distances sit in parallel arrays.
 
 #define HASHMAP_INITIAL_CAPACITY 131072  // Power of 2, suitable for ~100k entries
+#define HASHMAP_DIST_EMPTY 0xFFFFu       // dist sentinel: slot is empty
 
+// v0.101: keys/values/dist live in ONE contiguous 64-byte-aligned block
+// (keys at the base, then values, then dist — each section starts on a
+// 64-byte boundary since capacity is a power of two >= 8). One allocator
+// round-trip per table instead of three; see hashmap_arrays_alloc.
 typedef struct {
-    int64_t key;
-    int64_t value;
-    int state;  // 0=empty, 1=occupied, 2=deleted (tombstone)
-} HashEntry;
-
-typedef struct {
-    HashEntry* entries;
+    int64_t* keys;    // base of the block, 64-byte aligned (SIMD probe target)
+    int64_t* values;
+    uint16_t* dist;   // probe distance from home slot; HASHMAP_DIST_EMPTY = free
     int64_t count;
     int64_t capacity;
 } HashMap;
 
+// v0.101: SIMD probing — x86-64 GCC/Clang only, scalar everywhere else.
+// The runtime is compiled for baseline x86-64, so the AVX2 body carries a
+// target attribute and is only entered after a CPUID check.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BMB_SIMD_X86 1
+#include <immintrin.h>
+#if !defined(__ELF__)
+// Only the non-ELF dispatch branch of hashmap_get needs the cached CPUID
+// check; ELF targets bind the variant at load time via ifunc instead
+static int bmb_cpu_has_avx2(void) {
+    static int cached = -1;
+    if (cached < 0) cached = __builtin_cpu_supports("avx2");
+    return cached;
+}
+#endif
+#endif
+
+// v0.101: 64-byte-aligned allocation for SIMD-probed arrays
+static void* bmb_alloc_aligned64(size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, 64);
+#else
+    void* p = NULL;
+    if (posix_memalign(&p, 64, size) != 0) return NULL;
+    return p;
+#endif
+}
+
+static void bmb_free_aligned64(void* p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
 // Hash function for i64 keys (Fibonacci hashing variant)
 static int64_t hashmap_hash_i64(int64_t key) {
     uint64_t h = (uint64_t)key * 0x517cc1b727220a95ULL;
     return (int64_t)(h ^ (h >> 32));
 }
 
+// v0.101: Allocate the keys/values/dist sections as one aligned block and
+// mark every slot empty. The dist section is initialized with a single
+// memset, since HASHMAP_DIST_EMPTY is the all-ones byte pattern.
+// Returns the block base (== keys) and fills the section pointers.
+static int64_t* hashmap_arrays_alloc(int64_t capacity, int64_t** values, uint16_t** dist) {
+    size_t block = (size_t)capacity * (2 * sizeof(int64_t) + sizeof(uint16_t));
+    int64_t* keys = (int64_t*)bmb_alloc_aligned64(block);
+    if (!keys) return NULL;
+    *values = keys + capacity;
+    *dist = (uint16_t*)(keys + 2 * capacity);
+    memset(*dist, 0xFF, (size_t)capacity * sizeof(uint16_t));
+    return keys;
+}
+
 int64_t hashmap_new(void) {
     HashMap* m = (HashMap*)malloc(sizeof(HashMap));
     if (!m) return 0;
-    m->entries = (HashEntry*)calloc(HASHMAP_INITIAL_CAPACITY, sizeof(HashEntry));
-    if (!m->entries) {
+    m->keys = hashmap_arrays_alloc(HASHMAP_INITIAL_CAPACITY, &m->values, &m->dist);
+    if (!m->keys) {
         free(m);
         return 0;
     }
@@ -2232,7 +2321,7 @@ int64_t hashmap_new(void) {
 void hashmap_free(int64_t handle) {
     if (!handle) return;
     HashMap* m = (HashMap*)handle;
-    free(m->entries);
+    bmb_free_aligned64(m->keys);  // values and dist live in the same block
     free(m);
 }
 
@@ -2242,80 +2331,263 @@ int64_t hashmap_len(int64_t handle) {
     return m->count;
 }
 
+// v0.101: Robin Hood placement for a key known to be absent (resize path).
+// Entries carry their probe distance; a new element steals the slot of any
+// resident that is closer to its home, then keeps probing with the evictee.
+static void hashmap_place(int64_t* keys, int64_t* values, uint16_t* dist,
+                          int64_t mask, int64_t key, int64_t value) {
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
+    for (;;) {
+        if (dist[idx] == HASHMAP_DIST_EMPTY) {
+            keys[idx] = key;
+            values[idx] = value;
+            dist[idx] = d;
+            return;
+        }
+        if (dist[idx] < d) {
+            // Rob the rich: swap with the closer-to-home resident
+            int64_t tk = keys[idx], tv = values[idx];
+            uint16_t td = dist[idx];
+            keys[idx] = key; values[idx] = value; dist[idx] = d;
+            key = tk; value = tv; d = td;
+        }
+        idx = (idx + 1) & mask;
+        d++;
+    }
+}
+
+// v0.101: Grow the table when load factor reaches 0.9.
+// Robin Hood probing keeps probe-length variance low enough to run at 90%
+// load (vs 75% for plain linear probing), so tables stay ~25% smaller.
+// Trigger is pure integer arithmetic (count*10 >= capacity*9) — no
+// uint-to-double convert or FP division on the hot insert path.
+static void hashmap_resize(HashMap* m) {
+    int64_t new_cap = m->capacity * 2;
+    int64_t* new_values;
+    uint16_t* new_dist;
+    int64_t* new_keys = hashmap_arrays_alloc(new_cap, &new_values, &new_dist);
+    if (!new_keys) return;
+    int64_t new_mask = new_cap - 1;
+    for (int64_t i = 0; i < m->capacity; i++) {
+        if (m->dist[i] != HASHMAP_DIST_EMPTY) {
+            hashmap_place(new_keys, new_values, new_dist, new_mask, m->keys[i], m->values[i]);
+        }
+    }
+    bmb_free_aligned64(m->keys);
+    m->keys = new_keys;
+    m->values = new_values;
+    m->dist = new_dist;
+    m->capacity = new_cap;
+}
+
 int64_t hashmap_insert(int64_t handle, int64_t key, int64_t value) {
     if (!handle) return 0;
     HashMap* m = (HashMap*)handle;
+    // v0.101: Resize at 90% load (integer compare, same pattern as str_hashmap)
+    if (m->count * 10 >= m->capacity * 9) {
+        hashmap_resize(m);
+    }
 
-    int64_t hash = hashmap_hash_i64(key);
     int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
 
-    for (int64_t i = 0; i < m->capacity; i++) {
-        HashEntry* e = &m->entries[idx];
-        if (e->state == 0 || e->state == 2) {
-            // Empty or deleted slot - insert here
-            e->key = key;
-            e->value = value;
-            e->state = 1;
+    // hashmap_resize returns without growing when its allocations fail, so
+    // the table can legally be completely full. With no empty slot a new key
+    // has nowhere to go and Robin Hood displacement would never terminate:
+    // update the key in place if present, otherwise fail the insert the way
+    // the pre-Robin-Hood code did (bounded scan, return 0).
+    if (m->count >= m->capacity) {
+        int64_t idx = hashmap_hash_i64(key) & mask;
+        for (int64_t i = 0; i < m->capacity; i++) {
+            if (m->keys[idx] == key && m->dist[idx] != HASHMAP_DIST_EMPTY) {
+                int64_t old = m->values[idx];
+                m->values[idx] = value;
+                return old;
+            }
+            idx = (idx + 1) & mask;
+        }
+        return 0;
+    }
+
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
+    int64_t cur_key = key;
+    int64_t cur_value = value;
+    int displacing = 0;  // set once we carry an evicted entry (key can't match)
+
+    // At least one slot is empty here, and the probe visits every slot
+    // within capacity steps, so the bound below is unreachable in practice —
+    // it exists so a corrupted table degrades into a failed insert instead
+    // of an infinite loop.
+    for (int64_t i = 0; i <= m->capacity; i++) {
+        if (m->dist[idx] == HASHMAP_DIST_EMPTY) {
+            // Empty slot - insert here
+            m->keys[idx] = cur_key;
+            m->values[idx] = cur_value;
+            m->dist[idx] = d;
             m->count++;
             return 0;
-        } else if (e->state == 1 && e->key == key) {
+        }
+        if (!displacing && m->keys[idx] == cur_key) {
             // Key exists - update value
-            int64_t old = e->value;
-            e->value = value;
+            int64_t old = m->values[idx];
+            m->values[idx] = cur_value;
             return old;
         }
+        if (m->dist[idx] < d) {
+            // Robin Hood swap: evict the closer-to-home resident and
+            // continue probing on its behalf
+            int64_t tk = m->keys[idx], tv = m->values[idx];
+            uint16_t td = m->dist[idx];
+            m->keys[idx] = cur_key; m->values[idx] = cur_value; m->dist[idx] = d;
+            cur_key = tk; cur_value = tv; d = td;
+            displacing = 1;
+        }
         idx = (idx + 1) & mask;
+        // Saturate one below the sentinel so extreme clustering can never
+        // write HASHMAP_DIST_EMPTY into an occupied slot
+        if (d < HASHMAP_DIST_EMPTY - 1) d++;
+        BMB_PREFETCH_R(&m->keys[(idx + 1) & mask]);
     }
-    return 0;  // Table full (shouldn't happen with proper sizing)
+    return 0;
 }
 
-int64_t hashmap_get(int64_t handle, int64_t key) {
+#ifdef BMB_SIMD_X86
+// v0.101: AVX2 probe — compare 4 contiguous keys per iteration with one
+// 256-bit compare instead of 4 branchy scalar compares. Termination uses a
+// 16-bit lane compare on the dist array: a lane reads as "closer to home
+// than we would be" (signed cmplt, where HASHMAP_DIST_EMPTY = -1 always
+// qualifies), which under Robin Hood ordering proves the key absent.
+// Falls back to single-slot steps near the wrap point of the table.
+__attribute__((target("avx2")))
+static int64_t hashmap_get_avx2(const HashMap* m, int64_t key) {
+    int64_t mask = m->capacity - 1;
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
+    const int64_t* keys = m->keys;
+    const uint16_t* dist = m->dist;
+    const __m256i target = _mm256_set1_epi64x(key);
+    const __m128i lane_off = _mm_set_epi16(0, 0, 0, 0, 3, 2, 1, 0);
+
+    for (;;) {
+        if (idx + 4 <= m->capacity) {
+            __m256i kv = _mm256_loadu_si256((const __m256i*)&keys[idx]);
+            int mm = _mm256_movemask_epi8(_mm256_cmpeq_epi64(kv, target));
+            while (mm) {
+                // Stale key bytes can linger in empty slots, so confirm
+                // occupancy before trusting a lane hit
+                int64_t pos = idx + (__builtin_ctz((unsigned)mm) >> 3);
+                if (dist[pos] != HASHMAP_DIST_EMPTY) return m->values[pos];
+                mm &= mm - 1;
+            }
+            __m128i dv = _mm_loadl_epi64((const __m128i*)&dist[idx]);
+            __m128i tv = _mm_add_epi16(_mm_set1_epi16((short)d), lane_off);
+            if (_mm_movemask_epi8(_mm_cmplt_epi16(dv, tv)) & 0xFF) {
+                return INT64_MIN;
+            }
+            idx += 4;
+            idx &= mask;
+            d += 4;
+            BMB_PREFETCH_R(&keys[(idx + 4) & mask]);
+        } else {
+            // Scalar step across the wrap point
+            if (dist[idx] == HASHMAP_DIST_EMPTY || dist[idx] < d) return INT64_MIN;
+            if (keys[idx] == key) return m->values[idx];
+            idx = (idx + 1) & mask;
+            d++;
+        }
+    }
+}
+#endif
+
+static int64_t hashmap_get_scalar(int64_t handle, int64_t key) {
     if (!handle) return INT64_MIN;
     HashMap* m = (HashMap*)handle;
 
-    int64_t hash = hashmap_hash_i64(key);
     int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
 
-    for (int64_t i = 0; i < m->capacity; i++) {
-        HashEntry* e = &m->entries[idx];
-        if (e->state == 0) {
-            // Empty slot - key not found
+    for (;;) {
+        if (m->dist[idx] == HASHMAP_DIST_EMPTY || m->dist[idx] < d) {
+            // Empty slot, or a resident closer to home than we are —
+            // Robin Hood ordering guarantees the key is absent
             return INT64_MIN;
-        } else if (e->state == 1 && e->key == key) {
+        }
+        if (m->keys[idx] == key) {
             // Found
-            return e->value;
+            return m->values[idx];
         }
-        // Continue probing (skip deleted slots)
         idx = (idx + 1) & mask;
+        d++;
+        BMB_PREFETCH_R(&m->keys[(idx + 1) & mask]);
     }
-    return INT64_MIN;
 }
 
+#ifdef BMB_SIMD_X86
+static int64_t hashmap_get_avx2_entry(int64_t handle, int64_t key) {
+    if (!handle) return INT64_MIN;
+    return hashmap_get_avx2((const HashMap*)handle, key);
+}
+#endif
+
+// v0.101: CPU dispatch for hashmap_get. On ELF targets the variant is bound
+// once at load time through an ifunc resolver, so calls from generated code
+// go straight to the right implementation with no per-call check. Elsewhere
+// (Mach-O, PE) a cached-capability branch does the same job one predictable
+// compare later.
+#if defined(BMB_SIMD_X86) && defined(__ELF__)
+static int64_t (*resolve_hashmap_get(void))(int64_t, int64_t) {
+    __builtin_cpu_init();  // resolvers run before normal initializers
+    if (__builtin_cpu_supports("avx2")) return hashmap_get_avx2_entry;
+    return hashmap_get_scalar;
+}
+int64_t hashmap_get(int64_t handle, int64_t key)
+    __attribute__((ifunc("resolve_hashmap_get")));
+#else
+int64_t hashmap_get(int64_t handle, int64_t key) {
+#ifdef BMB_SIMD_X86
+    if (bmb_cpu_has_avx2()) return hashmap_get_avx2_entry(handle, key);
+#endif
+    return hashmap_get_scalar(handle, key);
+}
+#endif
+
+// v0.101: Backshift deletion — instead of leaving a tombstone, pull each
+// displaced successor one slot toward its home until a home entry (dist 0)
+// or empty slot ends the chain. Probe chains stay pristine, so load factor
+// reflects live entries only and lookups never degrade under churn.
 int64_t hashmap_remove(int64_t handle, int64_t key) {
     if (!handle) return INT64_MIN;
     HashMap* m = (HashMap*)handle;
 
-    int64_t hash = hashmap_hash_i64(key);
     int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
 
-    for (int64_t i = 0; i < m->capacity; i++) {
-        HashEntry* e = &m->entries[idx];
-        if (e->state == 0) {
-            // Empty slot - key not found
+    for (;;) {
+        if (m->dist[idx] == HASHMAP_DIST_EMPTY || m->dist[idx] < d) {
+            // Key not found
             return INT64_MIN;
-        } else if (e->state == 1 && e->key == key) {
-            // Found - mark as deleted (tombstone)
-            int64_t old = e->value;
-            e->state = 2;
-            m->count--;
-            return old;
         }
+        if (m->keys[idx] == key) break;
         idx = (idx + 1) & mask;
+        d++;
+        BMB_PREFETCH_R(&m->keys[(idx + 1) & mask]);
+    }
+
+    int64_t old = m->values[idx];
+    for (;;) {
+        int64_t j = (idx + 1) & mask;
+        if (m->dist[j] == HASHMAP_DIST_EMPTY || m->dist[j] == 0) break;
+        m->keys[idx] = m->keys[j];
+        m->values[idx] = m->values[j];
+        m->dist[idx] = m->dist[j] - 1;
+        idx = j;
     }
-    return INT64_MIN;
+    m->dist[idx] = HASHMAP_DIST_EMPTY;
+    m->count--;
+    return old;
 }
 
 // v0.60.262: Check if key exists in hashmap
@@ -2323,22 +2595,23 @@ int64_t hashmap_contains(int64_t handle, int64_t key) {
     if (!handle) return 0;
     HashMap* m = (HashMap*)handle;
 
-    int64_t hash = hashmap_hash_i64(key);
     int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
+    int64_t idx = hashmap_hash_i64(key) & mask;
+    uint16_t d = 0;
 
-    for (int64_t i = 0; i < m->capacity; i++) {
-        HashEntry* e = &m->entries[idx];
-        if (e->state == 0) {
-            // Empty slot - key not found
+    for (;;) {
+        if (m->dist[idx] == HASHMAP_DIST_EMPTY || m->dist[idx] < d) {
+            // Key not found
             return 0;
-        } else if (e->state == 1 && e->key == key) {
+        }
+        if (m->keys[idx] == key) {
             // Found
             return 1;
         }
         idx = (idx + 1) & mask;
+        d++;
+        BMB_PREFETCH_R(&m->keys[(idx + 1) & mask]);
     }
-    return 0;
 }
 
 // v0.95: hashmap_keys(handle) → vec of keys
@@ -2347,8 +2620,8 @@ int64_t hashmap_keys(int64_t handle) {
     if (!handle) return v;
     HashMap* m = (HashMap*)handle;
     for (int64_t i = 0; i < m->capacity; i++) {
-        if (m->entries[i].state == 1) {
-            bmb_vec_push(v, m->entries[i].key);
+        if (m->dist[i] != HASHMAP_DIST_EMPTY) {
+            bmb_vec_push(v, m->keys[i]);
         }
     }
     return v;
@@ -2360,25 +2633,34 @@ int64_t hashmap_values(int64_t handle) {
     if (!handle) return v;
     HashMap* m = (HashMap*)handle;
     for (int64_t i = 0; i < m->capacity; i++) {
-        if (m->entries[i].state == 1) {
-            bmb_vec_push(v, m->entries[i].value);
+        if (m->dist[i] != HASHMAP_DIST_EMPTY) {
+            bmb_vec_push(v, m->values[i]);
         }
     }
     return v;
 }
 
 // v0.90.82: String-content hashmap (keys compared by string content, not pointer identity)
-// Uses FNV-1a hash of string bytes for distribution, strcmp for equality
-// Same open-addressing with linear probing as the i64 hashmap
+// Uses FNV-1a hash of string bytes for distribution, memcmp for equality
+// v0.101: Swiss-table-style control bytes — occupancy state plus a 7-bit
+// partial hash (h2) live in a separate byte array, so a probe scans pure
+// metadata (16 slots per SSE2 compare on x86-64, where SSE2 is part of the
+// base ISA) and only touches entries[] and the string bytes on an h2 match.
+// This removes almost all str_key_eq calls from the probe loop.
 
 typedef struct {
     int64_t key;    // BmbString* (stored as i64)
     int64_t value;  // arbitrary i64 value
-    int state;      // 0=empty, 1=occupied, 2=deleted
 } StrHashEntry;
 
+// Control byte values: top bit set = not occupied, else the 7-bit h2
+#define STR_CTRL_EMPTY   0x80
+#define STR_CTRL_DELETED 0xFE
+#define STR_CTRL_OCCUPIED(c) ((c) < 0x80)
+
 typedef struct {
     StrHashEntry* entries;
+    uint8_t* ctrl;
     int64_t count;
     int64_t capacity;
 } StrHashMap;
@@ -2395,6 +2677,12 @@ static int64_t str_hash_content(int64_t key_handle) {
     return (int64_t)(h ^ (h >> 32));
 }
 
+// 7-bit partial hash stored in the control byte (top bits; the table index
+// uses the low bits, so the two stay independent)
+static uint8_t str_hash_h2(int64_t hash) {
+    return (uint8_t)(((uint64_t)hash >> 57) & 0x7F);
+}
+
 // Compare two BmbString* by content
 static int str_key_eq(int64_t a, int64_t b) {
     if (a == b) return 1;  // Same pointer
@@ -2411,7 +2699,14 @@ int64_t str_hashmap_new(void) {
     StrHashMap* m = (StrHashMap*)malloc(sizeof(StrHashMap));
     if (!m) return 0;
     m->entries = (StrHashEntry*)calloc(STR_HASHMAP_INITIAL_CAPACITY, sizeof(StrHashEntry));
-    if (!m->entries) { free(m); return 0; }
+    m->ctrl = (uint8_t*)malloc(STR_HASHMAP_INITIAL_CAPACITY);
+    if (!m->entries || !m->ctrl) {
+        free(m->entries);
+        free(m->ctrl);
+        free(m);
+        return 0;
+    }
+    memset(m->ctrl, STR_CTRL_EMPTY, STR_HASHMAP_INITIAL_CAPACITY);
     m->count = 0;
     m->capacity = STR_HASHMAP_INITIAL_CAPACITY;
     return (int64_t)m;
@@ -2421,6 +2716,7 @@ void str_hashmap_free(int64_t handle) {
     if (!handle) return;
     StrHashMap* m = (StrHashMap*)handle;
     free(m->entries);
+    free(m->ctrl);
     free(m);
 }
 
@@ -2428,24 +2724,79 @@ void str_hashmap_free(int64_t handle) {
 static void str_hashmap_resize(StrHashMap* m) {
     int64_t new_cap = m->capacity * 2;
     StrHashEntry* new_entries = (StrHashEntry*)calloc(new_cap, sizeof(StrHashEntry));
-    if (!new_entries) return;
+    uint8_t* new_ctrl = (uint8_t*)malloc(new_cap);
+    if (!new_entries || !new_ctrl) {
+        free(new_entries);
+        free(new_ctrl);
+        return;
+    }
+    memset(new_ctrl, STR_CTRL_EMPTY, new_cap);
     int64_t new_mask = new_cap - 1;
     for (int64_t i = 0; i < m->capacity; i++) {
-        StrHashEntry* old = &m->entries[i];
-        if (old->state == 1) {
-            int64_t hash = str_hash_content(old->key);
+        if (STR_CTRL_OCCUPIED(m->ctrl[i])) {
+            int64_t hash = str_hash_content(m->entries[i].key);
             int64_t idx = hash & new_mask;
-            while (new_entries[idx].state == 1) {
+            while (STR_CTRL_OCCUPIED(new_ctrl[idx])) {
                 idx = (idx + 1) & new_mask;
             }
-            new_entries[idx] = *old;
+            new_entries[idx] = m->entries[i];
+            new_ctrl[idx] = str_hash_h2(hash);
         }
     }
     free(m->entries);
+    free(m->ctrl);
     m->entries = new_entries;
+    m->ctrl = new_ctrl;
     m->capacity = new_cap;
 }
 
+// v0.101: Shared probe: returns the slot index of the key or -1.
+// On x86-64 this compares 16 control bytes per iteration; candidate h2
+// matches before the first empty byte in the group are verified by
+// content, and a group containing an empty byte ends the probe.
+static int64_t str_hashmap_find(const StrHashMap* m, int64_t key, int64_t hash) {
+    int64_t mask = m->capacity - 1;
+    int64_t idx = hash & mask;
+    uint8_t h2 = str_hash_h2(hash);
+    int64_t probes = 0;
+#ifdef BMB_SIMD_X86
+    const __m128i match_v = _mm_set1_epi8((char)h2);
+    const __m128i empty_v = _mm_set1_epi8((char)STR_CTRL_EMPTY);
+    for (; probes < m->capacity;) {
+        if (idx + 16 <= m->capacity) {
+            __m128i g = _mm_loadu_si128((const __m128i*)&m->ctrl[idx]);
+            int mm = _mm_movemask_epi8(_mm_cmpeq_epi8(g, match_v));
+            int em = _mm_movemask_epi8(_mm_cmpeq_epi8(g, empty_v));
+            if (em) mm &= (em & -em) - 1;  // only candidates before the first empty
+            while (mm) {
+                int64_t pos = idx + __builtin_ctz((unsigned)mm);
+                if (str_key_eq(m->entries[pos].key, key)) return pos;
+                mm &= mm - 1;
+            }
+            if (em) return -1;
+            idx = (idx + 16) & mask;
+            probes += 16;
+            BMB_PREFETCH_R(&m->ctrl[(idx + 16) & mask]);
+        } else {
+            // Scalar step across the wrap point
+            uint8_t c = m->ctrl[idx];
+            if (c == STR_CTRL_EMPTY) return -1;
+            if (c == h2 && str_key_eq(m->entries[idx].key, key)) return idx;
+            idx = (idx + 1) & mask;
+            probes++;
+        }
+    }
+#else
+    for (; probes < m->capacity; probes++) {
+        uint8_t c = m->ctrl[idx];
+        if (c == STR_CTRL_EMPTY) return -1;
+        if (c == h2 && str_key_eq(m->entries[idx].key, key)) return idx;
+        idx = (idx + 1) & mask;
+    }
+#endif
+    return -1;
+}
+
 int64_t str_hashmap_insert(int64_t handle, int64_t key, int64_t value) {
     if (!handle) return 0;
     StrHashMap* m = (StrHashMap*)handle;
@@ -2454,22 +2805,24 @@ int64_t str_hashmap_insert(int64_t handle, int64_t key, int64_t value) {
         str_hashmap_resize(m);
     }
     int64_t hash = str_hash_content(key);
+    uint8_t h2 = str_hash_h2(hash);
     int64_t mask = m->capacity - 1;
     int64_t idx = hash & mask;
     for (int64_t i = 0; i < m->capacity; i++) {
-        StrHashEntry* e = &m->entries[idx];
-        if (e->state == 0 || e->state == 2) {
-            e->key = key;
-            e->value = value;
-            e->state = 1;
+        uint8_t c = m->ctrl[idx];
+        if (!STR_CTRL_OCCUPIED(c)) {
+            m->entries[idx].key = key;
+            m->entries[idx].value = value;
+            m->ctrl[idx] = h2;
             m->count++;
             return 0;
-        } else if (e->state == 1 && str_key_eq(e->key, key)) {
-            int64_t old = e->value;
-            e->value = value;
+        } else if (c == h2 && str_key_eq(m->entries[idx].key, key)) {
+            int64_t old = m->entries[idx].value;
+            m->entries[idx].value = value;
             return old;
         }
         idx = (idx + 1) & mask;
+        BMB_PREFETCH_R(&m->ctrl[(idx + 1) & mask]);
     }
     return 0;
 }
@@ -2477,32 +2830,15 @@ int64_t str_hashmap_insert(int64_t handle, int64_t key, int64_t value) {
 int64_t str_hashmap_get(int64_t handle, int64_t key) {
     if (!handle) return 0;
     StrHashMap* m = (StrHashMap*)handle;
-    int64_t hash = str_hash_content(key);
-    int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
-    for (int64_t i = 0; i < m->capacity; i++) {
-        StrHashEntry* e = &m->entries[idx];
-        if (e->state == 0) return 0;
-        if (e->state == 1 && str_key_eq(e->key, key)) return e->value;
-        idx = (idx + 1) & mask;
-    }
-    return 0;
+    int64_t pos = str_hashmap_find(m, key, str_hash_content(key));
+    return pos < 0 ? 0 : m->entries[pos].value;
 }
 
 // v0.95: str_hashmap_contains
 int64_t str_hashmap_contains(int64_t handle, int64_t key) {
     if (!handle) return 0;
     StrHashMap* m = (StrHashMap*)handle;
-    int64_t hash = str_hash_content(key);
-    int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
-    for (int64_t i = 0; i < m->capacity; i++) {
-        StrHashEntry* e = &m->entries[idx];
-        if (e->state == 0) return 0;
-        if (e->state == 1 && str_key_eq(e->key, key)) return 1;
-        idx = (idx + 1) & mask;
-    }
-    return 0;
+    return str_hashmap_find(m, key, str_hash_content(key)) >= 0 ? 1 : 0;
 }
 
 // v0.95: str_hashmap_len
@@ -2516,21 +2852,12 @@ int64_t str_hashmap_len(int64_t handle) {
 int64_t str_hashmap_remove(int64_t handle, int64_t key) {
     if (!handle) return 0;
     StrHashMap* m = (StrHashMap*)handle;
-    int64_t hash = str_hash_content(key);
-    int64_t mask = m->capacity - 1;
-    int64_t idx = hash & mask;
-    for (int64_t i = 0; i < m->capacity; i++) {
-        StrHashEntry* e = &m->entries[idx];
-        if (e->state == 0) return 0;
-        if (e->state == 1 && str_key_eq(e->key, key)) {
-            int64_t old_val = e->value;
-            e->state = 2; // tombstone
-            m->count--;
-            return old_val;
-        }
-        idx = (idx + 1) & mask;
-    }
-    return 0;
+    int64_t pos = str_hashmap_find(m, key, str_hash_content(key));
+    if (pos < 0) return 0;
+    int64_t old_val = m->entries[pos].value;
+    m->ctrl[pos] = STR_CTRL_DELETED; // tombstone
+    m->count--;
+    return old_val;
 }
 
 // v0.95: str_hashmap_keys → vec of key ptrs (BmbString*)
@@ -2539,7 +2866,7 @@ int64_t str_hashmap_keys(int64_t handle) {
     if (!handle) return v;
     StrHashMap* m = (StrHashMap*)handle;
     for (int64_t i = 0; i < m->capacity; i++) {
-        if (m->entries[i].state == 1) {
+        if (STR_CTRL_OCCUPIED(m->ctrl[i])) {
             bmb_vec_push(v, m->entries[i].key);
         }
     }
@@ -2552,7 +2879,7 @@ int64_t str_hashmap_values(int64_t handle) {
     if (!handle) return v;
     StrHashMap* m = (StrHashMap*)handle;
     for (int64_t i = 0; i < m->capacity; i++) {
-        if (m->entries[i].state == 1) {
+        if (STR_CTRL_OCCUPIED(m->ctrl[i])) {
             bmb_vec_push(v, m->entries[i].value);
         }
     }
@@ -2592,25 +2919,21 @@ int64_t bmb_str_hashmap_values(int64_t handle) { return str_hashmap_values(handl
 
 // v0.98.9: BmbSvec (String Vector) C infrastructure (Cycle 2886)
 // Provides native svec_new/push/len/get/free/join/index_of/contains
+// v0.101: Handles are direct BmbSvec* pointers (same scheme as hashmap_*),
+// replacing indices into a grow-only global pool. No per-call pool bounds
+// check or extra indirection, no arbitrary cap, and bmb_svec_free now
+// returns the memory instead of parking a dead slot forever.
 typedef struct { BmbString** data; int64_t len; int64_t cap; } BmbSvec;
-static BmbSvec* g_svec_pool = NULL;
-static int64_t g_svec_pool_len = 0;
-static int64_t g_svec_pool_cap = 0;
 
 int64_t bmb_svec_new(void) {
-    if (g_svec_pool_len >= g_svec_pool_cap) {
-        int64_t nc = g_svec_pool_cap == 0 ? 16 : g_svec_pool_cap * 2;
-        g_svec_pool = (BmbSvec*)realloc(g_svec_pool, nc * sizeof(BmbSvec));
-        if (!g_svec_pool) return -1;
-        g_svec_pool_cap = nc;
-    }
-    int64_t h = g_svec_pool_len++;
-    g_svec_pool[h].data = NULL; g_svec_pool[h].len = 0; g_svec_pool[h].cap = 0;
-    return h;
+    BmbSvec* sv = (BmbSvec*)malloc(sizeof(BmbSvec));
+    if (!sv) return 0;
+    sv->data = NULL; sv->len = 0; sv->cap = 0;
+    return (int64_t)sv;
 }
 int64_t bmb_svec_push(int64_t handle, BmbString* s) {
-    if (handle < 0 || handle >= g_svec_pool_len) return -1;
-    BmbSvec* sv = &g_svec_pool[handle];
+    if (!handle) return -1;
+    BmbSvec* sv = (BmbSvec*)handle;
     if (sv->len >= sv->cap) {
         int64_t nc = sv->cap == 0 ? 8 : sv->cap * 2;
         sv->data = (BmbString**)realloc(sv->data, nc * sizeof(BmbString*));
@@ -2621,25 +2944,25 @@ int64_t bmb_svec_push(int64_t handle, BmbString* s) {
     return 0;
 }
 int64_t bmb_svec_len(int64_t handle) {
-    if (handle < 0 || handle >= g_svec_pool_len) return 0;
-    return g_svec_pool[handle].len;
+    if (!handle) return 0;
+    return ((BmbSvec*)handle)->len;
 }
 BmbString* bmb_svec_get(int64_t handle, int64_t index) {
-    if (handle < 0 || handle >= g_svec_pool_len) return NULL;
-    BmbSvec* sv = &g_svec_pool[handle];
-    if (index < 0 || index >= sv->len) return NULL;
+    if (!handle) return NULL;
+    BmbSvec* sv = (BmbSvec*)handle;
+    if ((uint64_t)index >= (uint64_t)sv->len) return NULL;  // covers index < 0
     return sv->data[index];
 }
 int64_t bmb_svec_free(int64_t handle) {
-    if (handle < 0 || handle >= g_svec_pool_len) return 0;
-    BmbSvec* sv = &g_svec_pool[handle];
-    if (sv->data) { free(sv->data); sv->data = NULL; }
-    sv->len = 0; sv->cap = 0;
+    if (!handle) return 0;
+    BmbSvec* sv = (BmbSvec*)handle;
+    if (sv->data) free(sv->data);
+    free(sv);
     return 0;
 }
 BmbString* bmb_svec_join(int64_t handle, BmbString* delim) {
-    if (handle < 0 || handle >= g_svec_pool_len) return bmb_string_new("", 0);
-    BmbSvec* sv = &g_svec_pool[handle];
+    if (!handle) return bmb_string_new("", 0);
+    BmbSvec* sv = (BmbSvec*)handle;
     if (sv->len == 0) return bmb_string_new("", 0);
     int64_t total = 0;
     for (int64_t i = 0; i < sv->len; i++) if (sv->data[i]) total += sv->data[i]->len;
@@ -2654,8 +2977,8 @@ BmbString* bmb_svec_join(int64_t handle, BmbString* delim) {
     return bmb_string_new(buf, total);
 }
 int64_t bmb_svec_index_of(int64_t handle, BmbString* needle) {
-    if (handle < 0 || handle >= g_svec_pool_len || !needle) return -1;
-    BmbSvec* sv = &g_svec_pool[handle];
+    if (!handle || !needle) return -1;
+    BmbSvec* sv = (BmbSvec*)handle;
     for (int64_t i = 0; i < sv->len; i++) {
         BmbString* s = sv->data[i];
         if (s && s->len == needle->len && memcmp(s->data, needle->data, needle->len) == 0) return i;
@@ -2679,22 +3002,22 @@ static int bmbstring_cmp(const void* a, const void* b) {
     return (int)(sa->len - sb->len);
 }
 int64_t bmb_svec_sort(int64_t handle) {
-    if (handle < 0 || handle >= g_svec_pool_len) return 0;
-    BmbSvec* sv = &g_svec_pool[handle];
+    if (!handle) return 0;
+    BmbSvec* sv = (BmbSvec*)handle;
     if (sv->len > 1) qsort(sv->data, (size_t)sv->len, sizeof(BmbString*), bmbstring_cmp);
     return 0;
 }
 int64_t bmb_svec_remove(int64_t handle, int64_t index) {
-    if (handle < 0 || handle >= g_svec_pool_len) return 0;
-    BmbSvec* sv = &g_svec_pool[handle];
-    if (index < 0 || index >= sv->len) return 0;
+    if (!handle) return 0;
+    BmbSvec* sv = (BmbSvec*)handle;
+    if ((uint64_t)index >= (uint64_t)sv->len) return 0;  // covers index < 0
     for (int64_t i = index; i < sv->len - 1; i++) sv->data[i] = sv->data[i + 1];
     sv->len--;
     return 1;
 }
 int64_t bmb_svec_clear(int64_t handle) {
-    if (handle < 0 || handle >= g_svec_pool_len) return 0;
-    g_svec_pool[handle].len = 0;
+    if (!handle) return 0;
+    ((BmbSvec*)handle)->len = 0;
     return 0;
 }
 
@@ -2791,7 +3114,7 @@ int64_t bmb_str_hashmap_keys(int64_t handle) {
     if (!handle) return sv;
     StrHashMap* m = (StrHashMap*)handle;
     for (int64_t i = 0; i < m->capacity; i++) {
-        if (m->entries[i].state == 1) {
+        if (STR_CTRL_OCCUPIED(m->ctrl[i])) {
             BmbString* k = (BmbString*)m->entries[i].key;
             bmb_svec_push(sv, k);
         }
@@ -2802,7 +3125,7 @@ int64_t bmb_str_hashmap_keys(int64_t handle) {
 int64_t bmb_str_hashmap_sorted_keys(int64_t handle) {
     int64_t sv = bmb_str_hashmap_keys(handle);
     // sort the BmbSvec data in-place
-    BmbSvec* vec = &g_svec_pool[sv];
+    BmbSvec* vec = (BmbSvec*)sv;
     if (vec->len > 1) {
         qsort(vec->data, (size_t)vec->len, sizeof(BmbString*), cmp_bmb_str_ptr);
     }
@@ -2897,8 +3220,91 @@ int64_t bmb_append_file(const char* path, const char* content) {
 
 // v0.46: System functions
 // v0.90: Updated to accept BmbString* for bootstrap compatibility
+// v0.101: Commands without shell metacharacters skip /bin/sh entirely and go
+// through posix_spawnp (vfork-style under glibc: no address-space copy, no
+// shell parse). Anything the shell would interpret falls back to system(),
+// and the returned value stays in wait-status format in both paths.
+#ifndef _WIN32
+static int64_t bmb_spawn_simple(const char* data, int64_t len) {
+    // Reject anything /bin/sh -c would treat specially; quotes and
+    // backslashes too, since we do no unquoting of our own
+    for (int64_t i = 0; i < len; i++) {
+        char c = data[i];
+        if (strchr("|&;<>$`*?[]#~=(){}'\"\\\n", c)) return INT64_MIN;
+    }
+    // Tokenize on whitespace (no quoting possible past the scan above)
+    char* buf = (char*)malloc((size_t)len + 1);
+    if (!buf) return INT64_MIN;
+    memcpy(buf, data, (size_t)len);
+    buf[len] = '\0';
+    char* argv[64];
+    int argc = 0;
+    char* pos = buf;
+    while (*pos && argc < 63) {
+        while (*pos == ' ' || *pos == '\t') pos++;
+        if (!*pos) break;
+        argv[argc++] = pos;
+        while (*pos && *pos != ' ' && *pos != '\t') pos++;
+        if (*pos) *pos++ = '\0';
+    }
+    if (argc == 0 || (*pos && argc == 63)) {
+        free(buf);
+        return INT64_MIN;
+    }
+    argv[argc] = NULL;
+    // Shell builtins (cd, exit, ...) have no binary on PATH; resolve argv[0]
+    // up front so they fall back to system() instead of exec-failing with 127
+    if (strchr(argv[0], '/')) {
+        if (access(argv[0], X_OK) != 0) {
+            free(buf);
+            return INT64_MIN;
+        }
+    } else {
+        const char* path = getenv("PATH");
+        if (!path) path = "/usr/local/bin:/usr/bin:/bin";
+        int found = 0;
+        char cand[4096];
+        while (!found && *path) {
+            const char* sep = strchr(path, ':');
+            size_t dlen = sep ? (size_t)(sep - path) : strlen(path);
+            size_t nlen = strlen(argv[0]);
+            if (dlen > 0 && dlen + 1 + nlen < sizeof(cand)) {
+                memcpy(cand, path, dlen);
+                cand[dlen] = '/';
+                memcpy(cand + dlen + 1, argv[0], nlen + 1);
+                if (access(cand, X_OK) == 0) found = 1;
+            }
+            path = sep ? sep + 1 : path + dlen;
+        }
+        if (!found) {
+            free(buf);
+            return INT64_MIN;
+        }
+    }
+    pid_t pid;
+    if (posix_spawnp(&pid, argv[0], NULL, NULL, argv, environ) != 0) {
+        free(buf);
+        return INT64_MIN;
+    }
+    free(buf);
+    // The child is running: from here on the fallback sentinel must not be
+    // returned, or bmb_system would run the command a second time through
+    // system(). Retry interrupted waits; report any other failure as -1.
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno == EINTR) continue;
+        return -1;
+    }
+    return (int64_t)status;
+}
+#endif
+
 int64_t bmb_system(const BmbString* cmd) {
     if (!cmd || !cmd->data) return -1;
+#ifndef _WIN32
+    int64_t status = bmb_spawn_simple(cmd->data, cmd->len);
+    if (status != INT64_MIN) return status;
+#endif
     return (int64_t)system(cmd->data);
 }
 
@@ -3137,20 +3543,91 @@ BmbString* exec_with_stdin(const BmbString* command, const BmbString* args, cons
 }
 
 // v0.90: Updated to accept/return BmbString* for bootstrap compatibility
+// v0.101: getenv memoization. libc getenv linearly scans environ on every
+// call, so repeated lookups of the same variable in a loop pay O(env_size)
+// each time plus a fresh string copy. Cache (name -> master BmbString*) in
+// a str_hashmap, keyed by content; masters are malloc'd (never arena) so an
+// arena reset cannot invalidate cached entries. Callers own the string they
+// receive (free_string is a public builtin), so every hit hands out a fresh
+// copy of the master, same ownership as before memoization — only the
+// environ scan is saved. Cache access is serialized by a mutex since
+// spawned threads may call getenv concurrently. The runtime exposes no
+// setenv, so a variable changed via raw libc setenv after its first lookup
+// keeps returning the cached value. Windows builds skip the cache (no
+// static mutex initializer there) and keep the original uncached path.
+#ifndef _WIN32
+static int64_t g_env_cache = 0;
+static pthread_mutex_t g_env_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static BmbString* bmb_string_dup_malloc(const char* src, size_t len) {
+    BmbString* s = (BmbString*)malloc(sizeof(BmbString));
+    char* data = (char*)malloc(len + 1);
+    if (!s || !data) {
+        free(s);
+        free(data);
+        return NULL;
+    }
+    memcpy(data, src, len);
+    data[len] = '\0';
+    s->data = data;
+    s->len = (int64_t)len;
+    s->cap = (int64_t)len;
+    return s;
+}
+#endif
+
+// Caller-owned copy, allocated the way the pre-cache code allocated results
+static BmbString* bmb_env_result_copy(const char* val, size_t len) {
+    char* out = (char*)bmb_alloc(len + 1);
+    memcpy(out, val, len);
+    out[len] = '\0';
+    return bmb_string_wrap(out);
+}
+
 BmbString* bmb_getenv(const BmbString* name) {
     const char* cname = name ? name->data : "";
+#ifdef _WIN32
     const char* val = getenv(cname);
-    if (!val) {
-        char* empty = (char*)bmb_alloc(1);
-        empty[0] = '\0';
-        return bmb_string_wrap(empty);
+    if (!val) return &g_bmb_empty_string;
+    return bmb_env_result_copy(val, strlen(val));
+#else
+    pthread_mutex_lock(&g_env_cache_lock);
+    if (!g_env_cache) g_env_cache = str_hashmap_new();
+    int64_t cached = g_env_cache ? str_hashmap_get(g_env_cache, (int64_t)name) : 0;
+    pthread_mutex_unlock(&g_env_cache_lock);
+    if (cached) {
+        BmbString* hit = (BmbString*)cached;
+        if (hit->len == 0) return &g_bmb_empty_string;
+        return bmb_env_result_copy(hit->data, (size_t)hit->len);
     }
-    // Return copy as BmbString
-    size_t len = 0;
-    while (val[len]) len++;
-    char* result = (char*)bmb_alloc(len + 1);
-    for (size_t i = 0; i <= len; i++) result[i] = val[i];
-    return bmb_string_wrap(result);
+
+    const char* val = getenv(cname);
+    size_t vlen = val ? strlen(val) : 0;
+    if (g_env_cache && name) {
+        pthread_mutex_lock(&g_env_cache_lock);
+        // Re-check under the lock so two threads racing on the same miss
+        // don't insert two masters
+        if (!str_hashmap_get(g_env_cache, (int64_t)name)) {
+            // The caller's name string may be arena-backed or freed; key
+            // the cache with a private copy
+            BmbString* key = bmb_string_dup_malloc(cname, (size_t)name->len);
+            BmbString* master =
+                val ? bmb_string_dup_malloc(val, vlen) : &g_bmb_empty_string;
+            if (key && master) {
+                str_hashmap_insert(g_env_cache, (int64_t)key, (int64_t)master);
+            } else {
+                if (key) { free(key->data); free(key); }
+                if (master && master != &g_bmb_empty_string) {
+                    free(master->data);
+                    free(master);
+                }
+            }
+        }
+        pthread_mutex_unlock(&g_env_cache_lock);
+    }
+    if (!val) return &g_bmb_empty_string;
+    return bmb_env_result_copy(val, vlen);
+#endif
 }
 
 // v0.46: File I/O support for CLI Independence
@@ -3447,9 +3924,11 @@ int64_t bmb_arg_count(void) {
 
 // v0.60.87: Returns BMB string struct, not raw C string
 BmbString* bmb_get_arg(int64_t index) {
-    if (index < 0 || index >= g_argc) {
+    // v0.101: single unsigned compare — a negative index wraps to a huge
+    // value, so one branch covers both out-of-range directions
+    if (!g_argv || (uint64_t)index >= (uint64_t)g_argc) {
         // Return empty string for out-of-bounds
-        return bmb_string_from_cstr("");
+        return &g_bmb_empty_string;
     }
     // Return the argument as a BMB string
     return bmb_string_from_cstr(g_argv[index]);
@@ -3478,20 +3957,14 @@ int64_t sb_push_range(int64_t handle, const BmbString* s, int64_t start, int64_t
 }
 
 // v0.51.51: sb_push_cstr takes raw char* for internal use
+// v0.101: bulk memcpy instead of a byte-at-a-time loop, same as bmb_sb_push
 int64_t sb_push_cstr(int64_t handle, const char* s) {
     if (!s || !handle) return 0;
     StringBuilder* sb = (StringBuilder*)handle;
-    int64_t slen = 0;
-    while (s[slen]) slen++;
-    while (sb->len + slen + 1 > sb->cap) {
-        sb->cap *= 2;
-        sb->data = (char*)realloc(sb->data, sb->cap);
-    }
-    for (int64_t i = 0; i < slen; i++) {
-        sb->data[sb->len + i] = s[i];
-    }
+    int64_t slen = (int64_t)strlen(s);
+    sb_grow(sb, sb->len + slen + 1);
+    memcpy(sb->data + sb->len, s, (size_t)slen);
     sb->len += slen;
-    sb->data[sb->len] = '\0';
     return sb->len;
 }
 
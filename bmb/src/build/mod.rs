@@ -1451,6 +1451,31 @@ fn link_native(
         // v0.70: Link pthread for threading support (part of System on macOS)
     }
 
+    // v0.101: Opt-in alternate allocator. BMB_MALLOC=jemalloc|mimalloc links
+    // the named library so its malloc/free interpose the libc ones for the
+    // whole produced binary (runtime included). Nothing is vendored — the
+    // library must be installed on the build machine; we fail at link time
+    // with a normal "cannot find -l..." error otherwise. Windows is excluded:
+    // allocator replacement there requires patching, not linking.
+    #[cfg(not(target_os = "windows"))]
+    {
+        if let Ok(alloc) = std::env::var("BMB_MALLOC") {
+            match alloc.as_str() {
+                "jemalloc" => {
+                    cmd.arg("-ljemalloc");
+                }
+                "mimalloc" => {
+                    cmd.arg("-lmimalloc");
+                }
+                "" | "system" => {}
+                other => eprintln!(
+                    "warning: ignoring unknown BMB_MALLOC value '{}' (expected jemalloc, mimalloc, or system)",
+                    other
+                ),
+            }
+        }
+    }
+
     let output_result = cmd.output()?;
 
     if !output_result.status.success() {